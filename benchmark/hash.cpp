@@ -0,0 +1,58 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <rsl/_impl/hash.hpp>
+
+template <typename F>
+void measure(char const* name, std::vector<std::string> const& keys, F&& hash) {
+  std::size_t bytes = 0;
+  for (auto const& key : keys) {
+    bytes += key.size();
+  }
+  // hash roughly 256 MiB per measurement
+  auto const rounds = std::max<std::size_t>(1, (std::size_t{256} << 20U) / bytes);
+
+  std::uint64_t sum = 0;
+  auto start        = std::chrono::steady_clock::now();
+  for (std::size_t round = 0; round < rounds; ++round) {
+    for (auto const& key : keys) {
+      sum += hash(std::string_view(key));
+    }
+  }
+  auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+  std::printf("%-12s %10.2f ns/key %8.2f GB/s (checksum %llu)\n",
+              name,
+              elapsed.count() / double(rounds * keys.size()),
+              double(rounds * bytes) / elapsed.count(),
+              static_cast<unsigned long long>(sum));
+}
+
+int main() {
+  for (std::size_t size : {8, 64, 4096}) {
+    std::vector<std::string> keys;
+    for (std::size_t idx = 0; idx < 1024; ++idx) {
+      auto key = std::string(size, 'a');
+      for (std::size_t pos = 0; pos < size; ++pos) {
+        key[pos] = static_cast<char>('a' + (idx * 31 + pos * 7) % 26);
+      }
+      keys.push_back(std::move(key));
+    }
+
+    std::printf("%zu byte keys\n", size);
+    measure("fnv1a", keys, [](std::string_view key) { return rsl::_impl::fnv1a(key); });
+    measure("hash_string", keys, [](std::string_view key) {
+      return rsl::_impl::hash_string(key);
+    });
+    measure("std::hash", keys, [](std::string_view key) {
+      return std::hash<std::string_view>{}(key);
+    });
+  }
+}
@@ -0,0 +1,77 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <rsl/serialize>
+#include <rsl/static_map>
+#include <rsl/trie>
+
+// compile with -DKEYS=16, -DKEYS=1000 and -DKEYS=10000
+#ifndef KEYS
+#define KEYS 1000
+#endif
+
+consteval std::vector<rsl::string_view> make_words() {
+  std::vector<rsl::string_view> words;
+  for (std::size_t idx = 0; idx < KEYS; ++idx) {
+    // spread the keys so they do not share long common prefixes
+    words.emplace_back(define_static_string("k" + rsl::to_string(idx * 7919 % 100003) + "_" +
+                                            rsl::to_string(idx)));
+  }
+  return words;
+}
+
+consteval std::vector<std::pair<rsl::string_view, int>> make_entries() {
+  std::vector<std::pair<rsl::string_view, int>> entries;
+  int idx = 0;
+  for (auto word : make_words()) {
+    entries.emplace_back(word, idx++);
+  }
+  return entries;
+}
+
+constexpr auto words = define_static_array(make_words());
+
+template <typename F>
+void measure(char const* name, std::vector<std::string> const& queries, F&& lookup) {
+  constexpr int rounds = 100;
+  long long sum        = 0;
+  auto start           = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; ++round) {
+    for (auto const& query : queries) {
+      sum += lookup(std::string_view(query));
+    }
+  }
+  auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+  std::printf("%-16s %8.2f ns/lookup (checksum %lld)\n",
+              name,
+              elapsed.count() / double(rounds * queries.size()),
+              sum);
+}
+
+int main() {
+  constexpr auto map  = rsl::static_map<rsl::string_view, int>{make_entries()};
+  constexpr auto trie = rsl::trie{make_words()};
+
+  std::unordered_map<std::string_view, int> hash_map;
+  std::vector<std::string> queries;
+  for (std::size_t idx = 0; idx < words.size(); ++idx) {
+    hash_map.emplace(words[idx], int(idx));
+    queries.emplace_back(words[idx]);
+    // half of all lookups miss
+    queries.emplace_back(std::string(words[idx]) + "x");
+  }
+
+  std::printf("%d keys\n", KEYS);
+  measure("rsl::static_map", queries, [&](std::string_view key) { return map.index_of(key); });
+  measure("rsl::trie", queries, [&](std::string_view key) { return trie.find(key); });
+  measure("unordered_map", queries, [&](std::string_view key) {
+    auto it = hash_map.find(key);
+    return it == hash_map.end() ? -1 : it->second;
+  });
+}
@@ -0,0 +1,25 @@
+#include <cstddef>
+#include <vector>
+
+#include <rsl/serialize>
+#include <rsl/trie>
+
+// compile-time benchmark, compile with -DWORDS=100, -DWORDS=1000 and -DWORDS=10000
+#ifndef WORDS
+#define WORDS 1000
+#endif
+
+consteval std::vector<rsl::string_view> make_words() {
+  std::vector<rsl::string_view> words;
+  for (std::size_t idx = 0; idx < WORDS; ++idx) {
+    // mix of shared and distinct prefixes
+    words.emplace_back(define_static_string("word_" + rsl::to_string(idx * 7919 % 100003) + "_" +
+                                            rsl::to_string(idx)));
+  }
+  return words;
+}
+
+int main(int argc, char** argv) {
+  constexpr auto trie = rsl::trie{make_words()};
+  return trie.find(argv[argc - 1]);
+}
@@ -1,5 +1,9 @@
 #pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <string_view>
 
 namespace rsl::_impl {
@@ -30,4 +34,142 @@ constexpr hash_t fnv1a(std::string_view str) {
   return FNV1a()(str).finalize();
 }
 
+// folded multiply: the high and low halves of the 128 bit product xor-ed together
+constexpr std::uint64_t fold_multiply(std::uint64_t lhs, std::uint64_t rhs) {
+  auto const product = static_cast<unsigned __int128>(lhs) * rhs;
+  return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64U);
+}
+
+constexpr inline std::uint64_t hash_secret[] = {0xa0761d6478bd642fULL,
+                                                0xe7037ed1a0b428dbULL,
+                                                0x8ebc6af09c88c6e3ULL,
+                                                0x589965cc75374cc3ULL};
+
+constexpr std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t value) {
+  return fold_multiply(seed ^ hash_secret[0], value ^ hash_secret[1]);
+}
+
+// little endian load of up to 8 bytes
+constexpr std::uint64_t load_bytes(char const* data, std::size_t size) {
+  std::uint64_t ret = 0;
+  if consteval {
+    for (std::size_t idx = 0; idx < size; ++idx) {
+      ret |= std::uint64_t{static_cast<unsigned char>(data[idx])} << (8 * idx);
+    }
+  } else {
+    if (size == 0) {
+      // data may be null for empty input
+      return ret;
+    }
+    std::memcpy(&ret, data, size);
+    if constexpr (std::endian::native == std::endian::big) {
+      // the bytes were copied to the most significant end
+      ret = std::byteswap(ret);
+    }
+  }
+  return ret;
+}
+
+/**
+ * Streaming hasher consuming 8 bytes per step with a folded multiply. Input is buffered, so the
+ * result only depends on the concatenation of all bytes passed, not on how they were split
+ * into calls. Same interface as FNV1a.
+ */
+class Hasher {
+  std::uint64_t state;
+  std::uint64_t buffer = 0;
+  std::size_t buffered = 0;
+  std::uint64_t length = 0;
+
+  // the state is part of both factors, only a word depending on the state can zero the product
+  constexpr void consume(std::uint64_t word) {
+    state = fold_multiply(state ^ word ^ hash_secret[0], state ^ hash_secret[1]);
+  }
+
+public:
+  constexpr explicit Hasher(std::uint64_t seed = 0) : state(seed ^ hash_secret[2]) {}
+
+  constexpr Hasher& operator()(char const* data, std::size_t size) {
+    length += size;
+    if (buffered != 0) {
+      auto const take = std::min(size, 8 - buffered);
+      buffer |= load_bytes(data, take) << (8 * buffered);
+      buffered += take;
+      data += take;
+      size -= take;
+      if (buffered < 8) {
+        return *this;
+      }
+      consume(buffer);
+      buffer   = 0;
+      buffered = 0;
+    }
+
+    for (; size >= 8; data += 8, size -= 8) {
+      consume(load_bytes(data, 8));
+    }
+    buffer   = load_bytes(data, size);
+    buffered = size;
+    return *this;
+  }
+
+  constexpr Hasher& operator()(std::string_view str) { return (*this)(str.data(), str.size()); }
+
+  [[nodiscard]] constexpr std::size_t finalize() const {
+    auto const tail = hash_combine(state ^ buffer, length ^ hash_secret[3]);
+    return fold_multiply(tail ^ hash_secret[0], tail ^ hash_secret[3]);
+  }
+};
+
+/**
+ * One-shot string hash reading up to 32 bytes per step. Keys of at most 16 bytes are handled with
+ * two overlapping loads, longer keys are folded 32 bytes at a time into two independent lanes,
+ * then 16 bytes at a time, and finish with the last 16 bytes of the input. Compile time
+ * evaluation loads bytes one by one and yields the same values as the runtime path.
+ */
+constexpr std::uint64_t hash_string(char const* data, std::size_t size, std::uint64_t seed = 0) {
+  seed ^= fold_multiply(seed ^ hash_secret[0], hash_secret[1]);
+  std::uint64_t lhs = 0;
+  std::uint64_t rhs = 0;
+  if (size <= 16) {
+    if (size >= 4) {
+      auto const offset = (size >> 3U) << 2U;
+      lhs = (load_bytes(data, 4) << 32U) | load_bytes(data + offset, 4);
+      rhs = (load_bytes(data + size - 4, 4) << 32U) | load_bytes(data + size - 4 - offset, 4);
+    } else if (size > 0) {
+      lhs = (std::uint64_t{static_cast<unsigned char>(data[0])} << 16U) |
+            (std::uint64_t{static_cast<unsigned char>(data[size >> 1U])} << 8U) |
+            std::uint64_t{static_cast<unsigned char>(data[size - 1])};
+    }
+  } else {
+    auto remaining = size;
+    if (remaining > 32) {
+      auto lane = seed;
+      do {
+        seed = fold_multiply(load_bytes(data, 8) ^ hash_secret[1], load_bytes(data + 8, 8) ^ seed);
+        lane = fold_multiply(load_bytes(data + 16, 8) ^ hash_secret[2],
+                             load_bytes(data + 24, 8) ^ lane);
+        data += 32;
+        remaining -= 32;
+      } while (remaining > 32);
+      seed ^= lane;
+    }
+    while (remaining > 16) {
+      seed = fold_multiply(load_bytes(data, 8) ^ hash_secret[1], load_bytes(data + 8, 8) ^ seed);
+      data += 16;
+      remaining -= 16;
+    }
+    lhs = load_bytes(data + remaining - 16, 8);
+    rhs = load_bytes(data + remaining - 8, 8);
+  }
+
+  auto const product = static_cast<unsigned __int128>(lhs ^ hash_secret[1]) * (rhs ^ seed);
+  lhs                = static_cast<std::uint64_t>(product);
+  rhs                = static_cast<std::uint64_t>(product >> 64U);
+  return fold_multiply(lhs ^ hash_secret[0] ^ size, rhs ^ hash_secret[1]);
+}
+
+constexpr std::uint64_t hash_string(std::string_view str, std::uint64_t seed = 0) {
+  return hash_string(str.data(), str.size(), seed);
+}
 }  // namespace rsl::_impl
\ No newline at end of file
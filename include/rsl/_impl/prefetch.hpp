@@ -0,0 +1,15 @@
+#pragma once
+
+namespace rsl::_impl {
+// hints the processor to fetch the cache line containing `address` for reading
+// no-op during constant evaluation or if the compiler provides no prefetch intrinsic
+constexpr void prefetch(void const* address) {
+  if !consteval {
+#if __has_builtin(__builtin_prefetch)
+    __builtin_prefetch(address, 0, 3);
+#else
+    (void)address;
+#endif
+  }
+}
+}  // namespace rsl::_impl
\ No newline at end of file
@@ -3,20 +3,29 @@
 #include <ranges>
 #include <algorithm>
 #include <bit>
+#include <concepts>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <rsl/string_view>
+#include <rsl/_impl/serialize/to_chars.hpp>
 
 namespace rsl::_serialize_impl {
 template <typename T>
 struct Enumerator {
   T value;
-  char const* name;
+  rsl::string_view name;
 };
 
 template <typename T>
 consteval auto sorted_enum_pairs() {
   auto enumerators =
       std::vector(std::from_range, enumerators_of(^^T) | std::views::transform([](auto e) {
-                                     return Enumerator(extract<T>(constant_of(e)),
-                                                       define_static_string(identifier_of(e)));
+                                     auto name = identifier_of(e);
+                                     return Enumerator<T>{
+                                         extract<T>(constant_of(e)),
+                                         {define_static_string(name), name.size()}};
                                    }));
 
   using sort_t = std::make_unsigned_t<std::underlying_type_t<T>>;
@@ -27,4 +36,20 @@ consteval auto sorted_enum_pairs() {
   return enumerators;
 }
 
+template <typename OutputIt>
+constexpr OutputIt copy_name(std::string_view name, OutputIt out) {
+  for (char c : name) {
+    *out++ = c;
+  }
+  return out;
+}
+
+// writes the decimal representation of `value` without going through a temporary string
+template <std::integral T, typename OutputIt>
+constexpr OutputIt write_integer(T value, OutputIt out) {
+  char buffer[max_chars<T>()]{};
+  auto const result = to_chars(buffer, buffer + sizeof buffer, value);
+  return copy_name(std::string_view(buffer, result.ptr), out);
+}
+
 }  // namespace rsl::_serialize_impl
\ No newline at end of file
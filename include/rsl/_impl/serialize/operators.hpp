@@ -57,9 +57,7 @@ constexpr std::string op_to_string(std::meta::operators op) {
 
 constexpr std::meta::operators to_operator(std::string_view text) {
   constexpr static auto hash = [](std::string_view str) constexpr {
-    auto hasher = _impl::FNV1a{};
-    hasher(str);
-    return hasher.finalize();
+    return _impl::hash_string(str);
   };
 
   switch (hash(text)) {
@@ -0,0 +1,452 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rsl::_serialize_impl {
+template <typename T>
+concept integer = std::integral<T> && !std::same_as<T, bool>;
+
+constexpr inline char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+constexpr inline std::uint64_t powers_of_10[] = {1ULL,
+                                                 10ULL,
+                                                 100ULL,
+                                                 1'000ULL,
+                                                 10'000ULL,
+                                                 100'000ULL,
+                                                 1'000'000ULL,
+                                                 10'000'000ULL,
+                                                 100'000'000ULL,
+                                                 1'000'000'000ULL,
+                                                 10'000'000'000ULL,
+                                                 100'000'000'000ULL,
+                                                 1'000'000'000'000ULL,
+                                                 10'000'000'000'000ULL,
+                                                 100'000'000'000'000ULL,
+                                                 1'000'000'000'000'000ULL,
+                                                 10'000'000'000'000'000ULL,
+                                                 100'000'000'000'000'000ULL,
+                                                 1'000'000'000'000'000'000ULL,
+                                                 10'000'000'000'000'000'000ULL};
+
+// 1233 / 4096 approximates log10(2), the estimate is off by at most one
+constexpr int count_digits(std::uint64_t value) {
+  auto const estimate = (std::bit_width(value | 1U) * 1233) >> 12U;
+  return estimate + ((value | 1U) >= powers_of_10[estimate] ? 1 : 0);
+}
+
+// writes exactly `count_digits(value)` digits ending at `last`, two at a time
+constexpr void write_digits(std::uint64_t value, char* last) {
+  while (value >= 100) {
+    auto const pair = (value % 100) * 2;
+    value /= 100;
+    *--last = digit_pairs[pair + 1];
+    *--last = digit_pairs[pair];
+  }
+  if (value >= 10) {
+    *--last = digit_pairs[value * 2 + 1];
+    *--last = digit_pairs[value * 2];
+  } else {
+    *--last = static_cast<char>('0' + value);
+  }
+}
+
+template <integer T>
+constexpr std::to_chars_result to_chars(char* first, char* last, T value) {
+  using unsigned_t = std::make_unsigned_t<T>;
+  auto magnitude   = static_cast<unsigned_t>(value);
+  bool negative    = false;
+  if constexpr (std::is_signed_v<T>) {
+    if (value < 0) {
+      negative  = true;
+      magnitude = unsigned_t(0) - magnitude;
+    }
+  }
+
+  auto const length = count_digits(magnitude) + (negative ? 1 : 0);
+  if (last - first < length) {
+    return {last, std::errc::value_too_large};
+  }
+  if (negative) {
+    *first = '-';
+  }
+  write_digits(magnitude, first + length);
+  return {first + length, std::errc{}};
+}
+
+// arbitrary precision unsigned integer, only used to format floating point values during
+// constant evaluation
+struct BigInt {
+  std::vector<std::uint32_t> limbs;  // least significant first, no leading zero limbs
+
+  constexpr explicit BigInt(std::uint64_t value) {
+    for (; value != 0; value >>= 32U) {
+      limbs.push_back(static_cast<std::uint32_t>(value));
+    }
+  }
+
+  constexpr BigInt& operator*=(std::uint32_t factor) {
+    std::uint64_t carry = 0;
+    for (auto& limb : limbs) {
+      carry += std::uint64_t{limb} * factor;
+      limb  = static_cast<std::uint32_t>(carry);
+      carry >>= 32U;
+    }
+    if (carry != 0) {
+      limbs.push_back(static_cast<std::uint32_t>(carry));
+    }
+    return *this;
+  }
+
+  constexpr BigInt& operator<<=(std::size_t bits) {
+    if (limbs.empty()) {
+      return *this;
+    }
+    limbs.insert(limbs.begin(), bits / 32, 0);
+    if (auto const shift = bits % 32; shift != 0) {
+      std::uint32_t carry = 0;
+      for (auto& limb : limbs) {
+        auto const next = limb >> (32 - shift);
+        limb            = (limb << shift) | carry;
+        carry           = next;
+      }
+      if (carry != 0) {
+        limbs.push_back(carry);
+      }
+    }
+    return *this;
+  }
+
+  constexpr BigInt& operator+=(BigInt const& other) {
+    limbs.resize(std::max(limbs.size(), other.limbs.size()), 0);
+    std::uint64_t carry = 0;
+    for (std::size_t idx = 0; idx < limbs.size(); ++idx) {
+      carry += limbs[idx];
+      carry += idx < other.limbs.size() ? other.limbs[idx] : 0;
+      limbs[idx] = static_cast<std::uint32_t>(carry);
+      carry >>= 32U;
+    }
+    if (carry != 0) {
+      limbs.push_back(static_cast<std::uint32_t>(carry));
+    }
+    return *this;
+  }
+
+  // requires *this >= other
+  constexpr BigInt& operator-=(BigInt const& other) {
+    std::int64_t borrow = 0;
+    for (std::size_t idx = 0; idx < limbs.size(); ++idx) {
+      borrow += std::int64_t{limbs[idx]};
+      borrow -= idx < other.limbs.size() ? std::int64_t{other.limbs[idx]} : 0;
+      limbs[idx] = static_cast<std::uint32_t>(borrow);
+      borrow     = borrow < 0 ? -1 : 0;
+    }
+    while (!limbs.empty() && limbs.back() == 0) {
+      limbs.pop_back();
+    }
+    return *this;
+  }
+
+  // divides in place and returns the remainder
+  constexpr std::uint32_t divide(std::uint32_t divisor) {
+    std::uint64_t rest = 0;
+    for (auto idx = limbs.size(); idx-- != 0;) {
+      rest       = (rest << 32U) | limbs[idx];
+      limbs[idx] = static_cast<std::uint32_t>(rest / divisor);
+      rest %= divisor;
+    }
+    while (!limbs.empty() && limbs.back() == 0) {
+      limbs.pop_back();
+    }
+    return static_cast<std::uint32_t>(rest);
+  }
+
+  friend constexpr BigInt operator+(BigInt lhs, BigInt const& rhs) { return lhs += rhs; }
+
+  friend constexpr int compare(BigInt const& lhs, BigInt const& rhs) {
+    if (lhs.limbs.size() != rhs.limbs.size()) {
+      return lhs.limbs.size() < rhs.limbs.size() ? -1 : 1;
+    }
+    for (auto idx = lhs.limbs.size(); idx-- != 0;) {
+      if (lhs.limbs[idx] != rhs.limbs[idx]) {
+        return lhs.limbs[idx] < rhs.limbs[idx] ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+};
+
+// exact decimal digits of a non-zero `value`, returns past-the-end
+constexpr char* write_integer(BigInt value, char* first) {
+  std::vector<std::uint32_t> groups;  // nine digits each, least significant first
+  while (!value.limbs.empty()) {
+    groups.push_back(value.divide(1'000'000'000));
+  }
+
+  auto const leading = count_digits(groups.back());
+  write_digits(groups.back(), first + leading);
+  first += leading;
+  for (auto idx = groups.size() - 1; idx-- != 0;) {
+    auto const digits = count_digits(groups[idx]);
+    first             = std::ranges::fill_n(first, 9 - digits, '0');
+    write_digits(groups[idx], first + digits);
+    first += digits;
+  }
+  return first;
+}
+
+// value = mantissa * 2^exponent
+struct Binary {
+  BigInt mantissa{0};
+  int exponent      = 0;
+  bool power_of_two = false;
+};
+
+// `value` must be positive and finite
+template <std::floating_point T>
+constexpr Binary decompose(T value) {
+  constexpr int precision    = std::numeric_limits<T>::digits;
+  constexpr int min_exponent = std::numeric_limits<T>::min_exponent - precision;
+
+  // scaling by powers of two is exact
+  int exponent = 0;
+  while (value >= T(0x1p32)) {
+    value /= T(0x1p32);
+    exponent += 32;
+  }
+  while (value >= 2) {
+    value /= 2;
+    ++exponent;
+  }
+  while (value < T(0x1p-32)) {
+    value *= T(0x1p32);
+    exponent -= 32;
+  }
+  while (value < 1) {
+    value *= 2;
+    --exponent;
+  }
+
+  // subnormals have fewer significant bits, the ones below the minimum exponent are all zero
+  auto const bits = precision - std::max(0, min_exponent - (exponent - (precision - 1)));
+
+  // value is in [1, 2), read its bits 32 at a time such that any precision fits
+  Binary ret{BigInt{1}, exponent - (bits - 1), value == 1};
+  auto rest = value - 1;
+  for (int remaining = bits - 1; remaining > 0;) {
+    auto const take = std::min(remaining, 32);
+    rest *= T(1ULL << take);
+    auto const chunk = static_cast<std::uint32_t>(rest);
+    rest -= T(chunk);
+    ret.mantissa <<= take;
+    ret.mantissa += BigInt{chunk};
+    remaining -= take;
+  }
+  return ret;
+}
+
+// shortest digit string that reads back as the same value, value = 0.digits * 10^exponent
+struct Decimal {
+  std::array<char, 40> digits{};  // binary128 needs up to 36
+  int count    = 0;
+  int exponent = 0;
+};
+
+// Burger & Dybvig, "Printing Floating-Point Numbers Quickly and Accurately", free-format
+// algorithm with exact arithmetic. `value` must be positive and finite
+template <std::floating_point T>
+constexpr Decimal shortest_decimal(T value) {
+  constexpr int min_exponent =
+      std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits;
+
+  auto [mantissa, exponent, power_of_two] = decompose(value);
+
+  // round-half-even on read back accepts values exactly on the boundaries for even mantissas
+  bool const inclusive = mantissa.limbs[0] % 2 == 0;
+  bool const lopsided  = power_of_two && exponent > min_exponent;
+
+  auto r      = std::move(mantissa);
+  auto s      = BigInt{1};
+  auto m_low  = BigInt{1};
+  auto m_high = BigInt{1};
+  if (exponent >= 0) {
+    r <<= exponent + (lopsided ? 2 : 1);
+    s <<= lopsided ? 2 : 1;
+    m_low <<= exponent;
+    m_high <<= exponent + (lopsided ? 1 : 0);
+  } else {
+    r <<= lopsided ? 2 : 1;
+    s <<= (lopsided ? 2 : 1) - exponent;
+    m_high <<= lopsided ? 1 : 0;
+  }
+
+  auto const reaches = [&](BigInt const& high) {
+    auto const order = compare(high, s);
+    return inclusive ? order >= 0 : order > 0;
+  };
+
+  Decimal ret;
+  while (reaches(r + m_high)) {
+    s *= 10;
+    ++ret.exponent;
+  }
+  for (;;) {
+    auto high = r + m_high;
+    high *= 10;
+    if (reaches(high)) {
+      break;
+    }
+    r *= 10;
+    m_low *= 10;
+    m_high *= 10;
+    --ret.exponent;
+  }
+
+  for (;;) {
+    r *= 10;
+    m_low *= 10;
+    m_high *= 10;
+    int digit = 0;
+    while (compare(r, s) >= 0) {
+      r -= s;
+      ++digit;
+    }
+
+    auto const order = compare(r, m_low);
+    bool const low   = inclusive ? order <= 0 : order < 0;
+    bool const high  = reaches(r + m_high);
+    if (low && high) {
+      // both candidates are within the rounding interval, pick the closer one
+      auto twice       = r + r;
+      auto const delta = compare(twice, s);
+      digit += delta > 0 || (delta == 0 && digit % 2 != 0) ? 1 : 0;
+    } else if (high) {
+      ++digit;
+    }
+    ret.digits[ret.count++] = static_cast<char>('0' + digit);
+    if (low || high) {
+      return ret;
+    }
+  }
+}
+
+template <std::floating_point T>
+constexpr std::to_chars_result constant_to_chars(char* first, char* last, T value) {
+  auto const put = [&](std::string_view text) -> std::to_chars_result {
+    if (last - first < static_cast<std::ptrdiff_t>(text.size())) {
+      return {last, std::errc::value_too_large};
+    }
+    return {std::ranges::copy(text, first).out, std::errc{}};
+  };
+
+  auto const negative = std::signbit(value);
+  if (std::isnan(value)) {
+    return put(negative ? "-nan" : "nan");
+  }
+  if (std::isinf(value)) {
+    return put(negative ? "-inf" : "inf");
+  }
+  if (value == 0) {
+    return put(negative ? "-0" : "0");
+  }
+
+  auto const decimal = shortest_decimal(negative ? -value : value);
+  auto const count   = decimal.count;
+  auto const point   = decimal.exponent;  // position of the decimal point in `digits`
+
+  // printf's %e and %f spellings of the same digits, %f wins ties
+  auto const scientific_exponent = point - 1;
+  auto const exponent_magnitude  = scientific_exponent < 0 ? -scientific_exponent
+                                                           : scientific_exponent;
+  auto const scientific_length =
+      count + (count > 1 ? 1 : 0) + 2 + std::max(2, count_digits(exponent_magnitude));
+  auto const fixed_length = point <= 0 ? 2 - point + count : point < count ? count + 1 : point;
+
+  auto const length = (negative ? 1 : 0) + std::min(fixed_length, scientific_length);
+  if (last - first < length) {
+    return {last, std::errc::value_too_large};
+  }
+
+  auto const* digits = decimal.digits.data();
+  if (negative) {
+    *first++ = '-';
+  }
+  if (fixed_length <= scientific_length) {
+    if (point <= 0) {
+      *first++ = '0';
+      *first++ = '.';
+      first    = std::ranges::fill_n(first, -point, '0');
+      first    = std::ranges::copy(digits, digits + count, first).out;
+    } else if (point < count) {
+      first    = std::ranges::copy(digits, digits + point, first).out;
+      *first++ = '.';
+      first    = std::ranges::copy(digits + point, digits + count, first).out;
+    } else if (auto binary = decompose(negative ? -value : value); binary.exponent > 0) {
+      // an integer wider than the mantissa, std::to_chars prints its exact digits rather than
+      // padding the shortest ones with zeros since that is closer at the same length
+      binary.mantissa <<= binary.exponent;
+      first = write_integer(std::move(binary.mantissa), first);
+    } else {
+      first = std::ranges::copy(digits, digits + count, first).out;
+      first = std::ranges::fill_n(first, point - count, '0');
+    }
+  } else {
+    *first++ = digits[0];
+    if (count > 1) {
+      *first++ = '.';
+      first    = std::ranges::copy(digits + 1, digits + count, first).out;
+    }
+    *first++ = 'e';
+    *first++ = scientific_exponent < 0 ? '-' : '+';
+    if (exponent_magnitude < 10) {
+      *first++ = '0';
+    }
+    auto const exponent_digits = count_digits(exponent_magnitude);
+    write_digits(exponent_magnitude, first + exponent_digits);
+    first += exponent_digits;
+  }
+  return {first, std::errc{}};
+}
+
+template <std::floating_point T>
+constexpr std::to_chars_result to_chars(char* first, char* last, T value) {
+  if consteval {
+    return constant_to_chars(first, last, value);
+  } else {
+    return std::to_chars(first, last, value);
+  }
+}
+
+template <typename T>
+consteval std::size_t max_chars() {
+  if constexpr (std::floating_point<T>) {
+    // sign, digits, point, 'e', exponent sign and exponent
+    return 1 + std::numeric_limits<T>::max_digits10 + 1 + 2 +
+           count_digits(std::numeric_limits<T>::max_exponent10);
+  } else {
+    return std::numeric_limits<T>::digits10 + 2;
+  }
+}
+}  // namespace rsl::_serialize_impl
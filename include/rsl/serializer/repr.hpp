@@ -8,6 +8,7 @@
 
 #include <rsl/meta_traits>
 #include <rsl/string_view>
+#include <rsl/_impl/serialize/to_chars.hpp>
 
 #include "machinery.hpp"
 
@@ -267,10 +268,8 @@ public:
     print_separator();
     std::array<char, 64> buffer{};
 
-    auto [ptr, ec] = std::to_chars(buffer.data(),
-                                   buffer.data() + buffer.size(),
-                                   value,
-                                   std::chars_format::general);
+    // shortest round-trip representation, also usable during constant evaluation
+    auto [ptr, ec] = _serialize_impl::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
     if (ec != std::errc{}) {
       out += "/* error */";
       return;
@@ -291,7 +290,7 @@ public:
   constexpr void operator()(auto, T value) {
     print_separator();
     std::array<char, 32> buffer{};  // Enough for any 64-bit integer including sign
-    auto [ptr, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    auto [ptr, ec] = _serialize_impl::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
 
     if (ec != std::errc{}) {
       out += "/* error */";
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <rsl/compact>
+
+namespace {
+struct Endpoint {
+  std::string host;
+  int port;
+};
+
+struct Route {
+  std::string name;
+  std::vector<Endpoint> endpoints;
+  std::optional<Endpoint> fallback;
+  std::vector<std::string> tags;
+  [[= rsl::skip]] int cache;
+};
+
+// hands out a single block and remembers where it is
+struct SingleBlock {
+  std::unique_ptr<std::byte[]> storage;
+  std::byte* base  = nullptr;
+  std::size_t size = 0;
+  int allocations  = 0;
+
+  void* allocate(std::size_t bytes, std::size_t alignment) {
+    ++allocations;
+    auto space = bytes + alignment;
+    storage    = std::make_unique<std::byte[]>(space);
+    void* ptr  = storage.get();
+    base       = static_cast<std::byte*>(std::align(alignment, bytes, ptr, space));
+    size       = bytes;
+    return base;
+  }
+
+  bool contains(void const* ptr, std::size_t bytes) const {
+    auto const* address = static_cast<std::byte const*>(ptr);
+    return address >= base && address + bytes <= base + size;
+  }
+};
+}  // namespace
+
+TEST(CompactClone, Types) {
+  using compact = rsl::compact_t<Route>;
+  ASSERT_TRUE((std::is_same_v<decltype(compact::name), std::string_view>));
+  ASSERT_TRUE(
+      (std::is_same_v<decltype(compact::endpoints), std::span<rsl::compact_t<Endpoint> const>>));
+  ASSERT_TRUE((std::is_same_v<decltype(compact::fallback), rsl::compact_t<Endpoint> const*>));
+  ASSERT_TRUE((std::is_same_v<decltype(compact::tags), std::span<std::string_view const>>));
+  ASSERT_TRUE(rsl::meta::get_member_by_name(^^compact, "cache") == std::meta::info{});
+}
+
+TEST(CompactClone, Clone) {
+  auto const original = Route{
+      "default",
+      {{"alpha", 80}, {"beta", 8080}},
+      Endpoint{"fallback", 443},
+      {"a", "bb", "ccc"},
+      42
+  };
+
+  SingleBlock arena;
+  auto const& clone = rsl::compact_clone(original, arena);
+  ASSERT_EQ(arena.allocations, 1);
+
+  ASSERT_EQ(clone.name, "default");
+  ASSERT_EQ(clone.endpoints.size(), 2);
+  ASSERT_EQ(clone.endpoints[0].host, "alpha");
+  ASSERT_EQ(clone.endpoints[1].port, 8080);
+  ASSERT_NE(clone.fallback, nullptr);
+  ASSERT_EQ(clone.fallback->host, "fallback");
+  ASSERT_EQ(clone.tags.size(), 3);
+  ASSERT_EQ(clone.tags[2], "ccc");
+
+  ASSERT_TRUE(arena.contains(&clone, sizeof(clone)));
+  ASSERT_TRUE(arena.contains(clone.name.data(), clone.name.size()));
+  ASSERT_TRUE(arena.contains(clone.endpoints.data(), clone.endpoints.size_bytes()));
+  ASSERT_TRUE(arena.contains(clone.endpoints[1].host.data(), clone.endpoints[1].host.size()));
+  ASSERT_TRUE(arena.contains(clone.fallback, sizeof(*clone.fallback)));
+  ASSERT_TRUE(arena.contains(clone.tags[2].data(), clone.tags[2].size()));
+}
+
+TEST(CompactClone, EmptyOptional) {
+  auto const original = Route{"empty", {}, std::nullopt, {}, 0};
+
+  SingleBlock arena;
+  auto const& clone = rsl::compact_clone(original, arena);
+  ASSERT_EQ(clone.fallback, nullptr);
+  ASSERT_TRUE(clone.endpoints.empty());
+  ASSERT_EQ(clone.name, "empty");
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <rsl/double_array_trie>
+
+TEST(DoubleArrayTrie, Find) {
+  auto builder = rsl::trie_builder{};
+  ASSERT_EQ(builder.add("cherry"), 0);
+  ASSERT_EQ(builder.add("apple"), 1);
+  ASSERT_EQ(builder.add("app"), 2);
+  ASSERT_EQ(builder.add("banana"), 3);
+
+  auto image = builder.build();
+  auto trie  = rsl::double_array_trie{image};
+
+  ASSERT_EQ(trie.size(), 4);
+  ASSERT_EQ(trie.find("cherry"), 0);
+  ASSERT_EQ(trie.find("apple"), 1);
+  ASSERT_EQ(trie.find("app"), 2);
+  ASSERT_EQ(trie.find("banana"), 3);
+
+  ASSERT_EQ(trie.find("ap"), -1);
+  ASSERT_EQ(trie.find("apples"), -1);
+  ASSERT_EQ(trie.find(""), -1);
+  ASSERT_FALSE(trie.matches("APPLE"));
+  ASSERT_TRUE(trie.matches("app"));
+}
+
+TEST(DoubleArrayTrie, Many) {
+  std::vector<std::string> storage;
+  for (int idx = 0; idx < 2000; ++idx) {
+    storage.push_back("word" + std::to_string(idx * 7919 % 10007) + "\xff" + std::to_string(idx));
+  }
+  std::vector<std::string_view> words(storage.begin(), storage.end());
+
+  auto image = rsl::trie_builder{words}.build();
+  // images are position independent, copying models loading them from a file
+  std::vector<std::byte> loaded(image.begin(), image.end());
+  auto trie = rsl::double_array_trie{loaded};
+
+  for (std::size_t idx = 0; idx < words.size(); ++idx) {
+    ASSERT_EQ(trie.find(words[idx]), int(idx));
+  }
+  ASSERT_FALSE(trie.matches("word"));
+}
+
+TEST(DoubleArrayTrie, Invalid) {
+  auto builder = rsl::trie_builder{};
+  builder.add("a");
+  builder.add("a");
+  ASSERT_THROW((void)builder.build(), std::invalid_argument);
+  ASSERT_THROW(builder.add(""), std::invalid_argument);
+
+  auto image = rsl::trie_builder{}.build();
+  image.pop_back();
+  ASSERT_THROW(rsl::double_array_trie{image}, std::invalid_argument);
+  ASSERT_THROW(rsl::double_array_trie{std::span<std::byte const>{}}, std::invalid_argument);
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <rsl/enum_map>
+
+namespace {
+enum class Sparse { foo = 0, bar = 10, baz = 20, also_bar = bar };
+}  // namespace
+
+TEST(EnumMap, Access) {
+  static_assert(rsl::enum_map<Sparse, int>::size() == 3);
+  static_assert(sizeof(rsl::enum_map<Sparse, int>) == 3 * sizeof(int));
+  static_assert(rsl::enum_map<Sparse, int>{{Sparse::baz, 3}}[Sparse::baz] == 3);
+
+  auto counters = rsl::enum_map<Sparse, int>{};
+  ++counters[Sparse::bar];
+  ++counters[Sparse::also_bar];
+  counters.at(Sparse::foo) = 7;
+  ASSERT_EQ(counters[Sparse::bar], 2);
+  ASSERT_EQ(counters[Sparse::foo], 7);
+  ASSERT_EQ(counters[Sparse::baz], 0);
+
+  ASSERT_TRUE(counters.contains(Sparse::baz));
+  ASSERT_FALSE(counters.contains(Sparse(5)));
+  ASSERT_EQ(counters.find(Sparse(5)), nullptr);
+  ASSERT_EQ(*counters.find(Sparse::foo), 7);
+  ASSERT_THROW((void)counters.at(Sparse(5)), std::out_of_range);
+}
+
+TEST(EnumMap, Iterate) {
+  constexpr auto names = rsl::enum_map<Sparse, std::string_view>{
+      {Sparse::baz, "baz"},
+      {Sparse::foo, "foo"},
+      {Sparse::bar, "bar"},
+  };
+
+  std::vector<Sparse> keys;
+  std::vector<std::string_view> values;
+  for (auto [key, value] : names) {
+    keys.push_back(key);
+    values.push_back(value);
+  }
+  ASSERT_EQ(keys, (std::vector{Sparse::foo, Sparse::bar, Sparse::baz}));
+  ASSERT_EQ(values, (std::vector<std::string_view>{"foo", "bar", "baz"}));
+
+  auto doubled = rsl::enum_map<Sparse, int>{{Sparse::foo, 1}, {Sparse::baz, 2}};
+  for (auto [key, value] : doubled) {
+    value *= 2;
+  }
+  ASSERT_EQ(doubled, (rsl::enum_map<Sparse, int>{{Sparse::foo, 2}, {Sparse::baz, 4}}));
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <rsl/enum_set>
+
+namespace {
+enum class State { idle = 0, running = 10, stopped = 20 };
+enum class Wide : int {};
+enum class[[= rsl::flag_enum]] Permission : unsigned {
+  none  = 0,
+  read  = 1,
+  write = 2,
+  exec  = 4,
+  rw    = 3,
+};
+}  // namespace
+
+TEST(EnumSet, Basic) {
+  static_assert(std::is_same_v<rsl::enum_set<State>::word_type, std::uint8_t>);
+  static_assert(rsl::enum_set<State>::capacity() == 3);
+  static_assert(rsl::enum_set<State>{State::idle}.contains(State::idle));
+
+  auto set = rsl::enum_set<State>{};
+  ASSERT_TRUE(set.empty());
+  ASSERT_TRUE(set.insert(State::stopped));
+  ASSERT_FALSE(set.insert(State::stopped));
+  ASSERT_TRUE(set.insert(State::idle));
+  ASSERT_EQ(set.size(), 2);
+  ASSERT_TRUE(set.contains(State::idle));
+  ASSERT_FALSE(set.contains(State::running));
+  ASSERT_FALSE(set.contains(State(5)));
+  ASSERT_THROW(set.insert(State(5)), std::out_of_range);
+
+  ASSERT_TRUE(set.erase(State::idle));
+  ASSERT_FALSE(set.erase(State::idle));
+  ASSERT_FALSE(set.erase(State(5)));
+  ASSERT_EQ(set.size(), 1);
+  set.clear();
+  ASSERT_TRUE(set.empty());
+
+  ASSERT_TRUE(rsl::enum_set<Wide>::all().empty());
+}
+
+TEST(EnumSet, Iterate) {
+  auto set = rsl::enum_set<State>{State::stopped, State::idle};
+  auto items = std::vector<State>(std::from_range, set);
+  ASSERT_EQ(items, (std::vector{State::idle, State::stopped}));
+
+  items.clear();
+  for (auto state : rsl::enum_set<State>::all()) {
+    items.push_back(state);
+  }
+  ASSERT_EQ(items, (std::vector{State::idle, State::running, State::stopped}));
+}
+
+TEST(EnumSet, Operators) {
+  using set = rsl::enum_set<State>;
+  auto a    = set{State::idle, State::running};
+  auto b    = set{State::running, State::stopped};
+  ASSERT_EQ(a | b, set::all());
+  ASSERT_EQ(a & b, set{State::running});
+  ASSERT_EQ(a - b, set{State::idle});
+  ASSERT_NE(a, b);
+}
+
+TEST(EnumSet, Flags) {
+  using set = rsl::enum_set<Permission>;
+  auto flags = set::from_flags(Permission::read | Permission::write);
+  ASSERT_EQ(flags, (set{Permission::read, Permission::write, Permission::rw}));
+  ASSERT_EQ(flags.to_flags(), Permission::rw);
+  ASSERT_EQ(set::from_flags(Permission::none), set{});
+  auto both = set{Permission::exec, Permission::read};
+  ASSERT_EQ(both.to_flags(), Permission::read | Permission::exec);
+}
\ No newline at end of file
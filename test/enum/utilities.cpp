@@ -1,6 +1,10 @@
 #include <rsl/enum>
 #include <gtest/gtest.h>
 
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
 namespace {
 enum Foo {
   foo,
@@ -21,12 +25,73 @@ enum class Zoinks : int {
   foo,
   bar = 10
 };
+
+enum class Contiguous : unsigned char { a = 3, b, also_b = b, c };
+enum class Dense : short { a = -2, b, also_b = b, c = 1 };
+enum class Sparse : long long { a = -1LL << 40, b = 3, c = 1LL << 40 };
 }
 
 TEST(Enum, IsNamed) {
   ASSERT_TRUE(rsl::in_enum<Foo>(Foo::bar));
   ASSERT_TRUE(rsl::in_enum<Foo>(Foo::foo));
   ASSERT_FALSE(rsl::in_enum<Foo>(20));
+
+  // contiguous
+  static_assert(rsl::_enum_impl::ValueSet<Contiguous>::strategy ==
+                rsl::_enum_impl::Strategy::range);
+  static_assert(rsl::in_enum<Contiguous>(Contiguous::c));
+  ASSERT_TRUE(rsl::in_enum<Contiguous>(3));
+  ASSERT_TRUE(rsl::in_enum<Contiguous>(4));
+  ASSERT_TRUE(rsl::in_enum<Contiguous>(5));
+  ASSERT_FALSE(rsl::in_enum<Contiguous>(2));
+  ASSERT_FALSE(rsl::in_enum<Contiguous>(6));
+  ASSERT_FALSE(rsl::in_enum<Contiguous>(-1));
+  ASSERT_FALSE(rsl::in_enum<Contiguous>(256 + 3));
+
+  // bitmap with a gap
+  static_assert(rsl::_enum_impl::ValueSet<Dense>::strategy == rsl::_enum_impl::Strategy::bitmap);
+  static_assert(rsl::in_enum<Dense>(Dense::a));
+  ASSERT_TRUE(rsl::in_enum<Dense>(-1));
+  ASSERT_TRUE(rsl::in_enum<Dense>(-2));
+  ASSERT_TRUE(rsl::in_enum<Dense>(1));
+  ASSERT_FALSE(rsl::in_enum<Dense>(0));
+  ASSERT_FALSE(rsl::in_enum<Dense>(-3));
+  ASSERT_FALSE(rsl::in_enum<Dense>(2));
+  ASSERT_FALSE(rsl::in_enum<Dense>(1 << 16));
+
+  // bitmap
+  ASSERT_TRUE(rsl::in_enum<Bar>(-1));
+  ASSERT_TRUE(rsl::in_enum<Bar>(5));
+  ASSERT_FALSE(rsl::in_enum<Bar>(0));
+  ASSERT_FALSE(rsl::in_enum<Bar>(-2));
+  ASSERT_FALSE(rsl::in_enum<Bar>(6));
+
+  // binary search
+  static_assert(rsl::in_enum<Sparse>(Sparse::c));
+  ASSERT_TRUE(rsl::in_enum<Sparse>(Sparse::a));
+  ASSERT_TRUE(rsl::in_enum<Sparse>(3));
+  ASSERT_FALSE(rsl::in_enum<Sparse>(4));
+  ASSERT_FALSE(rsl::in_enum<Sparse>((1LL << 40) + 1));
+  ASSERT_FALSE(rsl::in_enum<Sparse>(-(1LL << 41)));
+}
+
+TEST(Enum, IsNamedBatch) {
+  std::array<short, 70> values{};
+  values.fill(-1);
+  values[3]  = 7;
+  values[66] = -5;
+
+  std::array<std::uint64_t, 2> mask{};
+  ASSERT_FALSE(rsl::in_enum<Dense>(values, mask));
+  ASSERT_EQ(mask[0], ~0ULL & ~(1ULL << 3));
+  ASSERT_EQ(mask[1], 0b111011ULL);
+
+  values[3] = values[66] = 1;
+  ASSERT_TRUE(rsl::in_enum<Dense>(values, mask));
+  ASSERT_EQ(mask[1], 0b111111ULL);
+
+  std::array<std::uint64_t, 1> small{};
+  ASSERT_THROW(rsl::in_enum<Dense>(values, small), std::invalid_argument);
 }
 
 TEST(Enum, InRange) {
@@ -52,4 +117,24 @@ TEST(Enum, InRange) {
   ASSERT_TRUE(rsl::in_range<Zoinks>(Zoinks::foo));
   ASSERT_TRUE(rsl::in_range<Zoinks>(Zoinks::bar));
   ASSERT_TRUE(rsl::in_range<Zoinks>(1234));
+}
+
+TEST(Enum, Name) {
+  static_assert(rsl::enum_name(Dense::a) == "a");
+  ASSERT_EQ(rsl::enum_name(Dense::b), "b");
+  ASSERT_EQ(rsl::enum_name(Dense::also_b), "b");
+  ASSERT_EQ(rsl::enum_name(Dense::c), "c");
+  ASSERT_EQ(rsl::enum_name(Dense(0)), "");
+  ASSERT_EQ(rsl::enum_name(Dense(-3)), "");
+  ASSERT_EQ(rsl::enum_name(Dense(2)), "");
+
+  static_assert(rsl::enum_name(Sparse::c) == "c");
+  ASSERT_EQ(rsl::enum_name(Sparse::a), "a");
+  ASSERT_EQ(rsl::enum_name(Sparse::b), "b");
+  ASSERT_EQ(rsl::enum_name(Sparse(4)), "");
+  ASSERT_EQ(rsl::enum_name(Sparse(-1)), "");
+
+  ASSERT_EQ(rsl::enum_name(Foo::bar), "bar");
+  ASSERT_EQ(rsl::enum_name(Baz::bar), "bar");
+  ASSERT_EQ(rsl::enum_name(Baz(11)), "");
 }
\ No newline at end of file
@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <rsl/hash>
+
+namespace demo {
+struct Point {
+  int x;
+  int y;
+
+  friend bool operator==(Point const&, Point const&) = default;
+};
+
+struct Named {
+  std::string name;
+  std::vector<int> values;
+  std::optional<double> weight;
+};
+
+struct Custom {
+  int id;
+  int cache;  // not part of the value
+};
+
+template <typename H>
+constexpr void hash_append(H& hasher, Custom const& value) {
+  rsl::hash_append(hasher, value.id);
+}
+
+struct Skipped {
+  int id;
+  [[= rsl::skip]] int cache;
+};
+
+struct Outer {
+  Point point;
+  Custom custom;
+};
+
+// counts the blocks of bytes passed
+struct CountingHasher {
+  std::size_t calls = 0;
+
+  constexpr void operator()(char const*, std::size_t) { ++calls; }
+  [[nodiscard]] constexpr std::size_t finalize() const { return calls; }
+};
+
+class Opaque {
+  int value = 0;
+
+public:
+  [[nodiscard]] int get() const { return value; }
+};
+}  // namespace demo
+
+TEST(Hash, Hasher) {
+  constexpr auto hash_chunks = [](std::string_view a, std::string_view b) {
+    rsl::default_hasher hasher;
+    hasher(a);
+    hasher(b);
+    return hasher.finalize();
+  };
+  constexpr auto hash_whole = [](std::string_view str) {
+    return rsl::default_hasher{}(str).finalize();
+  };
+
+  // only the concatenation of the input matters
+  static_assert(hash_chunks("hello ", "world, hashing") == hash_whole("hello world, hashing"));
+  ASSERT_EQ(hash_chunks("abc", "defghijklmnop"), hash_whole("abcdefghijklmnop"));
+  ASSERT_EQ(hash_chunks("", "abc"), hash_whole("abc"));
+
+  static_assert(hash_whole("") != hash_whole(std::string_view("\0", 1)));
+  ASSERT_NE(hash_whole("abc"), hash_whole("abd"));
+  ASSERT_NE(rsl::default_hasher{1}("abc").finalize(), hash_whole("abc"));
+}
+
+TEST(Hash, HasherKeepsPrefix) {
+  // a word that cancels the multiplier must not reset the state
+  constexpr auto hash_words = [](std::uint64_t first, std::uint64_t second) {
+    char bytes[16]{};
+    for (std::size_t idx = 0; idx < 8; ++idx) {
+      bytes[idx]     = static_cast<char>(first >> (8 * idx));
+      bytes[idx + 8] = static_cast<char>(second >> (8 * idx));
+    }
+    return rsl::default_hasher{}(bytes, sizeof bytes).finalize();
+  };
+
+  constexpr auto secret = rsl::_impl::hash_secret[1];
+  static_assert(hash_words(1, secret) != hash_words(2, secret));
+  for (auto word : {secret, secret ^ 1U, rsl::_impl::hash_secret[0]}) {
+    ASSERT_NE(hash_words(1, word), hash_words(2, word));
+  }
+}
+
+TEST(Hash, ConstantMatchesRuntime) {
+  constexpr auto hash = rsl::hash<>{};
+  constexpr auto constant = hash(std::tuple(1, 2.5, std::string_view("abc")));
+  auto runtime            = std::tuple(1, 2.5, std::string_view("abc"));
+  ASSERT_EQ(constant, hash(runtime));
+
+  constexpr auto point = hash(demo::Point{1, 2});
+  ASSERT_EQ(point, hash(demo::Point{1, 2}));
+}
+
+TEST(Hash, Values) {
+  auto const hash = rsl::hash<>{};
+  ASSERT_EQ(hash(std::string("abc")), hash(std::string_view("abc")));
+  ASSERT_EQ(hash(0.0), hash(-0.0));
+  ASSERT_NE(hash(std::optional<int>{}), hash(std::optional<int>{0}));
+
+  // sizes are appended, element boundaries are not ambiguous
+  ASSERT_NE(hash(std::tuple(std::string("ab"), std::string("c"))),
+            hash(std::tuple(std::string("a"), std::string("bc"))));
+  ASSERT_NE(hash(std::vector<int>{}), hash(std::vector<int>{0}));
+}
+
+TEST(Hash, Variant) {
+  auto const hash = rsl::hash<>{};
+  using variant_type = rsl::variant<int, int>;
+  ASSERT_NE(hash(variant_type(std::in_place_index<0>, 1)),
+            hash(variant_type(std::in_place_index<1>, 0)));
+  ASSERT_EQ(hash(variant_type(std::in_place_index<1>, 3)),
+            hash(variant_type(std::in_place_index<1>, 3)));
+
+  using std_variant = std::variant<int, int>;
+  ASSERT_NE(hash(std_variant(std::in_place_index<0>, 1)),
+            hash(std_variant(std::in_place_index<1>, 0)));
+}
+
+TEST(Hash, Aggregate) {
+  auto const hash = rsl::hash<>{};
+  ASSERT_EQ(hash(demo::Point{1, 2}), hash(std::tuple(1, 2)));
+  ASSERT_NE(hash(demo::Point{1, 2}), hash(demo::Point{2, 1}));
+
+  auto const named = demo::Named{"foo", {1, 2, 3}, 1.5};
+  ASSERT_EQ(hash(named), hash(demo::Named{"foo", {1, 2, 3}, 1.5}));
+  ASSERT_NE(hash(named), hash(demo::Named{"foo", {1, 2, 3}, {}}));
+  ASSERT_NE(hash(named), hash(demo::Named{"foo", {1, 2}, 1.5}));
+
+  // hash_append overloads found through ADL take precedence
+  ASSERT_EQ(hash(demo::Custom{1, 2}), hash(demo::Custom{1, 3}));
+  ASSERT_EQ(hash(std::vector{demo::Custom{1, 2}}), hash(std::vector{demo::Custom{1, 3}}));
+}
+
+TEST(Hash, Bytewise) {
+  constexpr auto count = rsl::hash<demo::CountingHasher>{};
+  auto const points    = std::vector<demo::Point>{
+      {1, 2},
+      {3, 4},
+      {5, 6}
+  };
+
+  // aggregates without padding and ranges of them are a single block, followed by the size
+  ASSERT_EQ(count(demo::Point{1, 2}), 1);
+  ASSERT_EQ(count(points), 2);
+  static_assert(count(demo::Point{1, 2}) == 1);
+
+  // ADL overloads and skipped members require appending member-wise
+  ASSERT_EQ(count(std::vector<demo::Custom>(3)), 4);
+  ASSERT_EQ(count(std::vector<demo::Skipped>(3)), 4);
+  ASSERT_EQ(count(std::vector<demo::Outer>(3)), 7);
+
+  auto const hash = rsl::hash<>{};
+  ASSERT_EQ(hash(points), hash(std::vector{std::tuple(1, 2), std::tuple(3, 4), std::tuple(5, 6)}));
+  ASSERT_EQ(hash(demo::Skipped{1, 2}), hash(demo::Skipped{1, 3}));
+  ASSERT_EQ(hash(std::vector{demo::Outer{{1, 2}, {3, 4}}}),
+            hash(std::vector{demo::Outer{{1, 2}, {3, 5}}}));
+}
+
+TEST(Hash, Hashable) {
+  static_assert(rsl::hashable<int>);
+  static_assert(rsl::hashable<float> && rsl::hashable<double>);
+  // the 80 bit x87 format is padded to 16 bytes
+  static_assert(std::numeric_limits<long double>::digits != 64 || !rsl::hashable<long double>);
+  static_assert(rsl::hashable<demo::Named>);
+  static_assert(rsl::hashable<std::vector<demo::Custom>>);
+  static_assert(rsl::hashable<rsl::variant<int, std::string>>);
+
+  // no std::hash and not an aggregate
+  static_assert(!rsl::hashable<demo::Opaque>);
+  static_assert(!rsl::hashable<std::vector<demo::Opaque>>);
+  static_assert(!rsl::hashable<std::optional<demo::Opaque>>);
+  static_assert(!rsl::hashable<std::variant<int, demo::Opaque>>);
+  static_assert(!rsl::hashable<rsl::tuple<int, demo::Opaque>>);
+  static_assert(!std::is_default_constructible_v<std::hash<rsl::tuple<int, demo::Opaque>>>);
+  static_assert(std::is_default_constructible_v<std::hash<rsl::tuple<int, std::string>>>);
+}
+
+TEST(Hash, Containers) {
+  std::unordered_map<demo::Point, int, rsl::hash<>> map;
+  map[{1, 2}] = 3;
+  map[{2, 1}] = 4;
+  ASSERT_EQ(map.size(), 2);
+
+  std::unordered_set<rsl::tuple<int, std::string>> set;
+  set.emplace(1, "foo");
+  set.emplace(1, "foo");
+  set.emplace(2, "foo");
+  ASSERT_EQ(set.size(), 2);
+}
\ No newline at end of file
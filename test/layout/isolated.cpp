@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <rsl/layout>
+
+namespace {
+struct Stats {
+  [[= rsl::isolated]] std::atomic<int> hits;
+  [[= rsl::isolated]] std::atomic<int> misses;
+  int config;
+  char flag;
+};
+
+struct Plain {
+  int a;
+  char b;
+};
+}  // namespace
+
+TEST(Isolated, Layout) {
+  using layout = rsl::isolated_layout<Stats>;
+  ASSERT_EQ(offsetof(layout, hits) % rsl::cache_line_size, 0);
+  ASSERT_EQ(offsetof(layout, misses) % rsl::cache_line_size, 0);
+  ASSERT_EQ(offsetof(layout, config) % rsl::cache_line_size, 0);
+  ASSERT_NE(offsetof(layout, hits) / rsl::cache_line_size,
+            offsetof(layout, misses) / rsl::cache_line_size);
+  ASSERT_NE(offsetof(layout, misses) / rsl::cache_line_size,
+            offsetof(layout, config) / rsl::cache_line_size);
+
+  // non-isolated neighbours may still share a line
+  ASSERT_EQ(offsetof(layout, flag) / rsl::cache_line_size,
+            offsetof(layout, config) / rsl::cache_line_size);
+  ASSERT_EQ(sizeof(layout) % rsl::cache_line_size, 0);
+}
+
+TEST(Isolated, Unannotated) {
+  using layout = rsl::isolated_layout<Plain>;
+  ASSERT_EQ(sizeof(layout), sizeof(Plain));
+  ASSERT_EQ(alignof(layout), alignof(Plain));
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <rsl/layout>
+
+namespace {
+struct Padded {
+  char a;
+  int b;
+  char c;
+};
+
+struct Straddling {
+  char pad[60];
+  char value[8];
+};
+
+struct Derived : Padded {
+  short d;
+};
+}  // namespace
+
+static_assert(rsl::layout_of<Padded>().padding_bytes <= 6);
+
+TEST(LayoutOf, Aggregate) {
+  constexpr auto layout = rsl::layout_of<Padded>();
+  ASSERT_EQ(layout.size, sizeof(Padded));
+  ASSERT_EQ(layout.alignment, alignof(Padded));
+  ASSERT_EQ(layout.members.size(), 3);
+
+  ASSERT_EQ(std::string_view(layout.members[0].name), "a");
+  ASSERT_EQ(layout.members[1].offset, offsetof(Padded, b));
+  ASSERT_EQ(layout.members[1].padding_before, 3);
+  ASSERT_EQ(layout.members[2].offset, offsetof(Padded, c));
+  ASSERT_EQ(layout.tail_padding, 3);
+  ASSERT_EQ(layout.padding_bytes, 6);
+  ASSERT_EQ(layout.straddling_members, 0);
+}
+
+TEST(LayoutOf, Bases) {
+  constexpr auto layout = rsl::layout_of<Derived>();
+  ASSERT_EQ(layout.members.size(), 4);
+  ASSERT_EQ(std::string_view(layout.members[3].name), "d");
+  ASSERT_EQ(layout.members[3].offset, offsetof(Derived, d));
+}
+
+TEST(LayoutOf, Straddling) {
+  constexpr auto layout = rsl::layout_of<Straddling>();
+  ASSERT_FALSE(layout.members[0].straddles_cache_line);
+  ASSERT_TRUE(layout.members[1].straddles_cache_line);
+  ASSERT_EQ(layout.straddling_members, 1);
+}
+
+TEST(LayoutOf, Tuple) {
+  using type            = rsl::tuple<char, std::uint32_t, char>;
+  constexpr auto layout = rsl::layout_of<type>();
+  ASSERT_EQ(layout.size, sizeof(type));
+  ASSERT_EQ(layout.members.size(), 3);
+  ASSERT_EQ(std::string_view(layout.members[1].name), "get<1>");
+  ASSERT_EQ(layout.members[1].padding_before, 3);
+  ASSERT_EQ(layout.padding_bytes, 6);
+}
+
+TEST(LayoutOf, Variant) {
+  using type            = rsl::variant<char, std::uint64_t>;
+  constexpr auto layout = rsl::layout_of<type>();
+  ASSERT_EQ(layout.size, sizeof(type));
+  ASSERT_EQ(layout.members.size(), 3);
+  ASSERT_EQ(layout.members[0].offset, 0);
+  ASSERT_EQ(layout.members[1].offset, 0);
+  ASSERT_EQ(std::string_view(layout.members[2].name), "index");
+  ASSERT_EQ(layout.padding_bytes, 7);
+
+  constexpr auto alternatives = rsl::alternative_layouts_of<type>();
+  ASSERT_EQ(alternatives.size(), 2);
+  ASSERT_EQ(alternatives[1].size, sizeof(std::uint64_t));
+}
+
+TEST(LayoutOf, Report) {
+  constexpr auto layout = rsl::layout_of<Padded>();
+  auto report           = layout.report();
+  ASSERT_NE(report.find("3 bytes padding"), std::string::npos);
+  ASSERT_NE(report.find("3 bytes tail padding"), std::string::npos);
+}
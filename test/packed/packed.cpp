@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <rsl/packed>
+
+namespace {
+enum class Color : std::uint8_t { red, green, blue };
+enum class Level : int { low = -2, mid = 0, high = 1 };
+enum class [[= rsl::flag_enum]] Flags : std::uint32_t { A = 1, B = 2, C = 4 };
+
+struct Record {
+  Color color;
+  bool enabled;
+  Level level;
+  Flags flags;
+  [[= rsl::value_range(0, 1000)]] int count;
+  [[= rsl::value_range(-100, 100)]] int delta;
+};
+
+struct Mixed {
+  Color color;
+  double value;
+};
+}  // namespace
+
+TEST(Packed, Size) {
+  // 2 + 1 + 2 + 3 + 10 + 8 bits
+  ASSERT_EQ(sizeof(rsl::packed<Record>), sizeof(std::uint32_t));
+  ASSERT_LT(sizeof(rsl::packed<Record>), sizeof(Record));
+}
+
+TEST(Packed, RoundTrip) {
+  auto const original = Record{Color::blue, true, Level::low, Flags::A | Flags::C, 1000, -100};
+  rsl::packed<Record> obj = original;
+  Record unpacked         = obj;
+
+  ASSERT_EQ(unpacked.color, original.color);
+  ASSERT_EQ(unpacked.enabled, original.enabled);
+  ASSERT_EQ(unpacked.level, original.level);
+  ASSERT_EQ(unpacked.flags, original.flags);
+  ASSERT_EQ(unpacked.count, original.count);
+  ASSERT_EQ(unpacked.delta, original.delta);
+}
+
+TEST(Packed, Accessors) {
+  rsl::packed<Record> obj{};
+  ASSERT_EQ(obj.get<^^Record::level>(), Level::mid);
+
+  obj.set<^^Record::level>(Level::high);
+  obj.set<^^Record::delta>(-7);
+  obj.set<^^Record::count>(512);
+  ASSERT_EQ(obj.get<^^Record::level>(), Level::high);
+  ASSERT_EQ(obj.get<^^Record::delta>(), -7);
+  ASSERT_EQ(obj.get<^^Record::count>(), 512);
+  ASSERT_FALSE(obj.get<^^Record::enabled>());
+}
+
+TEST(Packed, Unpacked) {
+  rsl::packed<Mixed> obj = Mixed{Color::green, 4.5};
+  ASSERT_EQ(obj.get<^^Mixed::color>(), Color::green);
+  ASSERT_EQ(obj.get<^^Mixed::value>(), 4.5);
+}
@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <format>
+#include <iterator>
+#include <optional>
+#include <string>
+
 #include <rsl/enum>
+#include <rsl/enum_from_string>
 #include <rsl/serialize>
 
 namespace {
@@ -63,4 +69,51 @@ TEST(ToString, FlagEnum) {
   ASSERT_EQ(rsl::to_string(F2(AC | AD)), "AC|D");
   ASSERT_EQ(rsl::to_string(F2(AC | 16)), "AC|F2(16)");
   ASSERT_EQ(rsl::to_string(F2(16)), "F2(16)");
+}
+
+TEST(ToString, FormatFlags) {
+  char buffer[32]{};
+  auto* end = rsl::format_flags(F2(AC | B | 16), buffer);
+  ASSERT_EQ(std::string_view(buffer, end), "AC|B|F2(16)");
+
+  std::string out;
+  rsl::format_flags(F1(0), std::back_inserter(out));
+  ASSERT_EQ(out, "");
+
+  ASSERT_EQ(std::format("{}", F1(AC | AD)), "AC|D");
+  ASSERT_EQ(std::format("[{}]", F2(16)), "[F2(16)]");
+
+  char fixed[4]{};
+  auto result = std::format_to_n(fixed, sizeof fixed, "{}", F2(AC | B));
+  ASSERT_EQ(result.size, 4);
+  ASSERT_EQ(std::string_view(fixed, sizeof fixed), "AC|B");
+}
+
+TEST(FromString, Enum) {
+  static_assert(rsl::enum_from_string<E4>("A4") == E4::A4);
+  ASSERT_EQ(rsl::enum_from_string<E1>("A1"), A1);
+  ASSERT_EQ(rsl::enum_from_string<E6>("A6"), E6::A6);
+  ASSERT_EQ(rsl::enum_from_string<E4>("A5"), std::nullopt);
+  ASSERT_EQ(rsl::enum_from_string<E4>(""), std::nullopt);
+
+  ASSERT_EQ(rsl::enum_from_string<E6>("E6(-7)"), E6(-7));
+  ASSERT_EQ(rsl::enum_from_string<E5>("E5(12)"), E5(12));
+  ASSERT_EQ(rsl::enum_from_string<E5>("E5(-1)"), std::nullopt);
+  ASSERT_EQ(rsl::enum_from_string<E5>("E5()"), std::nullopt);
+  ASSERT_EQ(rsl::enum_from_string<E5>("E5(1x)"), std::nullopt);
+  ASSERT_EQ(rsl::enum_from_string<E5>("E4(1)"), std::nullopt);
+}
+
+TEST(FromString, FlagEnum) {
+  ASSERT_EQ(rsl::enum_from_string<F2>("ALSO_A"), F2::A);
+  ASSERT_EQ(rsl::enum_from_string<F2>("AC|B|D"), F2(AC | B | D));
+  ASSERT_EQ(rsl::enum_from_string<F2>("B | D"), F2(B | D));
+  ASSERT_EQ(rsl::enum_from_string<F2>(""), F2(0));
+  ASSERT_EQ(rsl::enum_from_string<F2>("A|"), std::nullopt);
+  ASSERT_EQ(rsl::enum_from_string<F2>("A|E"), std::nullopt);
+
+  for (int raw = 0; raw < 64; ++raw) {
+    ASSERT_EQ(rsl::enum_from_string<F1>(rsl::to_string(F1(raw))), F1(raw));
+    ASSERT_EQ(rsl::enum_from_string<F2>(rsl::to_string(F2(raw))), F2(raw));
+  }
 }
\ No newline at end of file
@@ -1,4 +1,10 @@
+#include <array>
+#include <charconv>
 #include <climits>
+#include <cstddef>
+#include <limits>
+#include <string_view>
+#include <system_error>
 #include <gtest/gtest.h>
 
 #include <rsl/serialize>
@@ -70,4 +76,95 @@ TEST(ToString, floating) {
   ASSERT_TRUE(rsl::to_string(1.23F).starts_with("1.23"));
   ASSERT_TRUE(rsl::to_string(1.23).starts_with("1.23"));
   ASSERT_TRUE(rsl::to_string(1.23L).starts_with("1.23"));
+
+  static_assert(rsl::to_string(1.5) == "1.5");
+  static_assert(rsl::to_string(0.1) == "0.1");
+  static_assert(rsl::to_string(-0.0) == "-0");
+  static_assert(rsl::to_string(100.0) == "100");
+  static_assert(rsl::to_string(123456.0) == "123456");
+  static_assert(rsl::to_string(0.0001) == "1e-04");
+  static_assert(rsl::to_string(1e23) == "1e+23");
+  static_assert(rsl::to_string(5e-324) == "5e-324");
+  static_assert(rsl::to_string(std::numeric_limits<double>::max()) == "1.7976931348623157e+308");
+  static_assert(rsl::to_string(0.3F) == "0.3");
+  static_assert(rsl::to_string(1e-45F) == "1e-45");
+  static_assert(rsl::to_string(std::numeric_limits<float>::infinity()) == "inf");
+}
+
+namespace {
+// null terminated
+template <typename T>
+using Buffer = std::array<char, rsl::max_chars<T> + 1>;
+
+template <typename T>
+constexpr Buffer<T> format_value(T value) {
+  Buffer<T> buffer{};
+  rsl::to_chars(buffer.data(), buffer.data() + rsl::max_chars<T>, value);
+  return buffer;
+}
+
+template <typename T, std::size_t N>
+void expect_same_at_runtime(std::array<T, N> const& samples,
+                            std::array<Buffer<T>, N> const& expected) {
+  for (std::size_t idx = 0; idx < N; ++idx) {
+    ASSERT_EQ(std::string_view(format_value(samples[idx]).data()),
+              std::string_view(expected[idx].data()));
+  }
+}
+}  // namespace
+
+TEST(ToChars, ConstantMatchesRuntime) {
+  constexpr auto doubles = std::array{
+      0.1, 0.3, 2.0 / 3, 1e22, 1e23, 9007199254740993.0, 1e-7, 123e-20, 2.5e-308,
+      4.9e-324, 1e308, -42.125, 65536.0, 1e15, 1e16, 1.5e-5, 0.001, 299792458.0,
+      // integers wider than the mantissa are printed with all of their digits
+      34411697941609193472.0, -5088143117563430912.0,
+  };
+  constexpr auto double_strings = [&] {
+    std::array<Buffer<double>, doubles.size()> ret{};
+    for (std::size_t idx = 0; idx < doubles.size(); ++idx) {
+      ret[idx] = format_value(doubles[idx]);
+    }
+    return ret;
+  }();
+  expect_same_at_runtime(doubles, double_strings);
+
+  constexpr auto floats =
+      std::array{0.1F, 1.0F / 3, 16777217.0F, 1e-40F, 3.4e38F, 7.0F, 1e10F, 125181712.0F};
+  constexpr auto float_strings = [&] {
+    std::array<Buffer<float>, floats.size()> ret{};
+    for (std::size_t idx = 0; idx < floats.size(); ++idx) {
+      ret[idx] = format_value(floats[idx]);
+    }
+    return ret;
+  }();
+  expect_same_at_runtime(floats, float_strings);
+
+  // wider than 64 bits of precision on some platforms
+  constexpr auto long_doubles = std::array{0.1L, 2.0L / 3, 1e300L, -42.125L, 1.5e-300L};
+  constexpr auto long_double_strings = [&] {
+    std::array<Buffer<long double>, long_doubles.size()> ret{};
+    for (std::size_t idx = 0; idx < long_doubles.size(); ++idx) {
+      ret[idx] = format_value(long_doubles[idx]);
+    }
+    return ret;
+  }();
+  expect_same_at_runtime(long_doubles, long_double_strings);
+}
+
+TEST(ToChars, Integral) {
+  char buffer[rsl::max_chars<long long>]{};
+  auto result = rsl::to_chars(buffer, buffer + sizeof buffer, LLONG_MIN);
+  ASSERT_EQ(result.ec, std::errc{});
+  ASSERT_EQ(std::string_view(buffer, result.ptr), "-9223372036854775808");
+
+  result = rsl::to_chars(buffer, buffer + 3, 1234);
+  ASSERT_EQ(result.ec, std::errc::value_too_large);
+
+  for (unsigned long long value = 1; value != 0 && value < ULLONG_MAX / 3; value = value * 3 + 1) {
+    char expected[32]{};
+    auto std_result = std::to_chars(expected, expected + sizeof expected, value);
+    result          = rsl::to_chars(buffer, buffer + sizeof buffer, value);
+    ASSERT_EQ(std::string_view(buffer, result.ptr), std::string_view(expected, std_result.ptr));
+  }
 }
\ No newline at end of file
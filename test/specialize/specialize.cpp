@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <rsl/specialize>
+
+namespace {
+enum class Kind { a = 10, b = 20, c = 30 };
+enum class [[= rsl::flag_enum]] Option : unsigned { x = 1, y = 4, z = 8 };
+
+constexpr auto twice = [](auto value) { return decltype(value)::value * 2; };
+}  // namespace
+
+TEST(Specialize, Values) {
+  // dense
+  ASSERT_EQ(rsl::specialize<1, 2, 3>(2, twice), 4);
+  // sparse
+  ASSERT_EQ(rsl::specialize<1, 2, 4, 8>(8, twice), 16);
+  ASSERT_EQ(rsl::specialize<-5, 3, 100>(-5, twice), -10);
+  static_assert(rsl::specialize<1, 2, 4, 8>(4, twice) == 8);
+}
+
+TEST(Specialize, NoMatch) {
+  ASSERT_THROW(rsl::specialize<1, 2, 4>(3, twice), std::out_of_range);
+  ASSERT_THROW(rsl::specialize<1, 2, 3>(-1, twice), std::out_of_range);
+  ASSERT_THROW(rsl::specialize<1, 2, 3>(1ULL << 40, twice), std::out_of_range);
+  ASSERT_EQ(rsl::specialize<1, 2, 4>(3, twice, [](int value) { return -value; }), -3);
+}
+
+TEST(Specialize, Enum) {
+  auto identity = [](auto value) {
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(value.value)>, Kind>);
+    return value.value;
+  };
+  for (auto kind : {Kind::a, Kind::b, Kind::c}) {
+    ASSERT_EQ(rsl::specialize_enum(kind, identity), kind);
+  }
+  ASSERT_THROW(rsl::specialize_enum(Kind(15), identity), std::out_of_range);
+}
+
+TEST(Specialize, FlagEnum) {
+  auto to_int = [](auto value) { return std::to_underlying(decltype(value)::value); };
+  for (unsigned raw = 0; raw < 16; ++raw) {
+    if (raw & 2U) {
+      ASSERT_THROW(rsl::specialize_enum(Option(raw), to_int), std::out_of_range);
+    } else {
+      ASSERT_EQ(rsl::specialize_enum(Option(raw), to_int), raw);
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <rsl/serialize>
+#include <rsl/static_map>
+
+namespace {
+enum class Method : std::uint8_t { get, post, put, patch };
+}
+
+TEST(StaticMap, String) {
+  constexpr auto map = rsl::static_map<rsl::string_view, Method>{
+      {{"GET", Method::get}, {"POST", Method::post}, {"PUT", Method::put}, {"PATCH", Method::patch}}
+  };
+
+  ASSERT_EQ(map.size(), 4);
+  ASSERT_EQ(map.at("GET"), Method::get);
+  ASSERT_EQ(map.at("POST"), Method::post);
+  ASSERT_EQ(map.at("PUT"), Method::put);
+  ASSERT_EQ(map.at("PATCH"), Method::patch);
+  static_assert(map["PUT"] == Method::put);
+
+  ASSERT_FALSE(map.contains(""));
+  ASSERT_FALSE(map.contains("get"));
+  ASSERT_FALSE(map.contains("PATCHES"));
+  ASSERT_EQ(map.find("DELETE"), nullptr);
+  ASSERT_THROW(map.at("DELETE"), std::out_of_range);
+
+  std::string runtime = "POST";
+  ASSERT_EQ(*map.find(runtime), Method::post);
+}
+
+TEST(StaticMap, Integer) {
+  constexpr auto map = rsl::static_map<int, int>{
+      {{-1, 1}, {0, 2}, {42, 3}, {1 << 20, 4}}
+  };
+
+  ASSERT_EQ(map.at(-1), 1);
+  ASSERT_EQ(map.at(0), 2);
+  ASSERT_EQ(map.at(42), 3);
+  ASSERT_EQ(map.at(1 << 20), 4);
+  ASSERT_FALSE(map.contains(1));
+}
+
+TEST(StaticMap, Enum) {
+  constexpr auto map = rsl::static_map<Method, bool>{
+      {{Method::get, false}, {Method::post, true}, {Method::put, true}}
+  };
+
+  ASSERT_FALSE(map.at(Method::get));
+  ASSERT_TRUE(map.at(Method::post));
+  ASSERT_TRUE(map.at(Method::put));
+  ASSERT_FALSE(map.contains(Method::patch));
+}
+
+namespace {
+consteval std::vector<std::pair<rsl::string_view, int>> make_entries(int count) {
+  std::vector<std::pair<rsl::string_view, int>> entries;
+  for (int idx = 0; idx < count; ++idx) {
+    entries.emplace_back(define_static_string("key" + rsl::to_string(idx)), idx);
+  }
+  return entries;
+}
+}  // namespace
+
+TEST(StaticMap, Many) {
+  constexpr auto map = rsl::static_map<rsl::string_view, int>{make_entries(500)};
+  for (int idx = 0; idx < 500; ++idx) {
+    ASSERT_EQ(map.at("key" + std::to_string(idx)), idx);
+  }
+  ASSERT_FALSE(map.contains("key500"));
+}
+
+
+TEST(StaticMap, FindMany) {
+  constexpr auto map = rsl::static_map<rsl::string_view, int>{make_entries(100)};
+
+  std::vector<std::string> storage;
+  for (int idx = 0; idx < 120; ++idx) {
+    storage.push_back("key" + std::to_string(idx));
+  }
+  std::vector<std::string_view> queries(storage.begin(), storage.end());
+  std::vector<int> out(queries.size());
+  map.find_many(queries, out);
+
+  for (std::size_t idx = 0; idx < queries.size(); ++idx) {
+    ASSERT_EQ(out[idx], map.index_of(queries[idx]));
+    if (idx < 100) {
+      ASSERT_EQ(map.values[out[idx]], int(idx));
+    } else {
+      ASSERT_EQ(out[idx], -1);
+    }
+  }
+}
\ No newline at end of file
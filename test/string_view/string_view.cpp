@@ -1,4 +1,7 @@
 #include <gtest/gtest.h>
+#include <array>
+#include <functional>
+#include <string>
 #include <rsl/string_view>
 
 TEST(StringView, Empty) {
@@ -23,3 +26,25 @@ TEST(StringView, Misc) {
   ASSERT_EQ(sizeof(rsl::string_view::value_type), 1);
   ASSERT_EQ(rsl::string_view("a").max_size(), std::numeric_limits<size_t>::max());
 }
+
+
+TEST(StringView, Hash) {
+  // covers the short, 16 and 32 byte paths of the hash
+  constexpr std::string_view text =
+      "the quick brown fox jumps over the lazy dog, then it jumps over the quick brown fox again";
+  constexpr auto hashes = [&] {
+    std::array<std::size_t, text.size() + 1> ret{};
+    for (std::size_t size = 0; size <= text.size(); ++size) {
+      ret[size] = std::hash<rsl::string_view>{}(rsl::string_view(text.data(), size));
+    }
+    return ret;
+  }();
+
+  auto const runtime = std::string(text);
+  for (std::size_t size = 0; size <= text.size(); ++size) {
+    ASSERT_EQ(std::hash<rsl::string_view>{}(rsl::string_view(runtime.data(), size)), hashes[size]);
+    if (size != 0) {
+      ASSERT_NE(hashes[size], hashes[size - 1]);
+    }
+  }
+}
\ No newline at end of file
@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <rsl/serialize>
 #include <rsl/trie>
 
 
@@ -31,4 +36,279 @@ TEST(Trie, Find) {
   ASSERT_EQ(trie.find("pear"), -1);
   ASSERT_EQ(trie.find(""), -1);
   ASSERT_EQ(trie.find("APPLE"), -1);
+}
+
+TEST(Trie, LongPrefixes) {
+  auto trie = rsl::trie{
+      {"content-length", "content-type", "content-encoding", "x"}
+  };
+
+  ASSERT_EQ(trie.find("content-length"), 0);
+  ASSERT_EQ(trie.find("content-type"), 1);
+  ASSERT_EQ(trie.find("content-encoding"), 2);
+  ASSERT_EQ(trie.find("x"), 3);
+
+  // mismatches inside of an edge must be rejected there
+  ASSERT_EQ(trie.find("content-lengtX"), -1);
+  ASSERT_EQ(trie.find("contXnt-type"), -1);
+  ASSERT_EQ(trie.find("content-"), -1);
+  ASSERT_EQ(trie.find("y"), -1);
+}
+
+TEST(Trie, Type) {
+  using keywords = [:rsl::trie_type({"if", "else", "elif"}):];
+  static_assert(keywords::find("if") == 0);
+  static_assert(keywords::find("else") == 1);
+  static_assert(keywords::find("elif") == 2);
+  static_assert(keywords::find("el") == -1);
+  ASSERT_TRUE(keywords::matches("elif"));
+  ASSERT_FALSE(keywords::matches("elifs"));
+}
+
+
+TEST(Trie, Map) {
+  auto map = rsl::trie_map<int>{
+      {{"GET", 1}, {"POST", 2}, {"PUT", 3}}
+  };
+
+  ASSERT_EQ(*map.find("GET"), 1);
+  ASSERT_EQ(*map.find("POST"), 2);
+  ASSERT_EQ(*map.find("PUT"), 3);
+  ASSERT_EQ(map.find("PATCH"), nullptr);
+  ASSERT_FALSE(map.matches("P"));
+
+  using methods = [:rsl::trie_map_type<int>({{"GET", 1}, {"POST", 2}}):];
+  static_assert(*methods::find("POST") == 2);
+}
+
+
+TEST(Trie, Switch) {
+  using methods = [:rsl::trie_type({"GET", "POST"}):];
+  auto handle   = [](std::string_view method) {
+    return rsl::string_switch<methods>(
+        method,
+        [] { return std::string("get"); },
+        [] { return std::string("post"); },
+        [] { return std::string("unknown"); });
+  };
+
+  ASSERT_EQ(handle("GET"), "get");
+  ASSERT_EQ(handle("POST"), "post");
+  ASSERT_EQ(handle("PUT"), "unknown");
+  ASSERT_EQ(handle(""), "unknown");
+}
+
+TEST(Trie, MatchPrefix) {
+  auto trie = rsl::trie{
+      {"=", "==", "===", "!=", "<"}
+  };
+
+  auto match = trie.match_prefix("=== b");
+  ASSERT_TRUE(match);
+  ASSERT_EQ(match.index, 2);
+  ASSERT_EQ(match.length, 3);
+
+  match = trie.match_prefix("=!");
+  ASSERT_EQ(match.index, 0);
+  ASSERT_EQ(match.length, 1);
+
+  match = trie.match_prefix("!");
+  ASSERT_FALSE(match);
+  ASSERT_EQ(match.length, 0);
+  ASSERT_FALSE(trie.match_prefix(""));
+}
+
+
+TEST(Trie, Scan) {
+  auto trie = rsl::trie{
+      {"=", "==", "!=", "<"}
+  };
+
+  std::vector<std::pair<int, std::string_view>> tokens;
+  trie.scan("a == b != c<d=", [&](int index, std::string_view token) {
+    tokens.emplace_back(index, token);
+  });
+
+  std::vector<std::pair<int, std::string_view>> expected = {
+      {1, "=="},
+      {2, "!="},
+      {3,  "<"},
+      {0,  "="}
+  };
+  ASSERT_EQ(tokens, expected);
+}
+
+TEST(MultiSearch, Search) {
+  using search = rsl::multi_search<"he", "she", "his", "hers">;
+
+  std::vector<std::pair<int, std::size_t>> found;
+  search::search("ushers", [&](int index, std::size_t offset) {
+    found.emplace_back(index, offset);
+  });
+
+  std::vector<std::pair<int, std::size_t>> expected = {
+      {1, 1},
+      {0, 2},
+      {3, 2}
+  };
+  ASSERT_EQ(found, expected);
+
+  ASSERT_EQ(search::count("his hers she"), 5);
+  ASSERT_EQ(search::count("nothing to see"), 0);
+  ASSERT_EQ(search::count(""), 0);
+  static_assert(search::count("hehe") == 2);
+}
+
+TEST(Trie, FindMany) {
+  auto trie = rsl::trie{
+      {"apple", "banana", "cherry"}
+  };
+
+  std::vector<std::string_view> keys = {"cherry", "pear", "apple", "", "banana", "bananas"};
+  std::vector<int> out(keys.size());
+  trie.find_many(keys, out);
+  ASSERT_EQ(out, (std::vector<int>{2, -1, 0, -1, 1, -1}));
+}
+
+TEST(Trie, InputOrder) {
+  auto trie = rsl::trie{
+      {"cherry", "apple", "banana"}
+  };
+
+  ASSERT_EQ(trie.find("cherry"), 0);
+  ASSERT_EQ(trie.find("apple"), 1);
+  ASSERT_EQ(trie.find("banana"), 2);
+}
+
+
+namespace {
+consteval std::vector<rsl::string_view> make_words(int count) {
+  std::vector<rsl::string_view> words;
+  for (int idx = count - 1; idx >= 0; --idx) {
+    words.emplace_back(define_static_string("w" + rsl::to_string(idx * 37 % 1009) + "_" +
+                                            rsl::to_string(idx)));
+  }
+  return words;
+}
+}  // namespace
+
+
+TEST(Trie, Flat) {
+  // large enough to be stored as flat tables
+  constexpr auto words = define_static_array(make_words(400));
+  auto trie            = rsl::trie{make_words(400)};
+
+  for (std::size_t idx = 0; idx < words.size(); ++idx) {
+    ASSERT_EQ(trie.find(std::string_view(words[idx])), int(idx));
+  }
+  ASSERT_EQ(trie.find("w"), -1);
+  ASSERT_EQ(trie.find("w0_0x"), -1);
+  ASSERT_FALSE(trie.matches(""));
+
+  auto match = trie.match_prefix("w0_0 tail");
+  ASSERT_EQ(match.index, 399);
+  ASSERT_EQ(match.length, 4);
+}
+
+TEST(Trie, FindManyFlat) {
+  constexpr auto words = define_static_array(make_words(400));
+  auto trie            = rsl::trie{make_words(400)};
+
+  // misses end in the middle of an edge, after an edge and at a missing child
+  std::vector<std::string_view> keys = {"w", "", "w0_0x", "w0_", "x"};
+  for (auto word : words) {
+    keys.emplace_back(word);
+  }
+  std::vector<int> out(keys.size());
+  trie.find_many(keys, out);
+
+  for (std::size_t idx = 0; idx < keys.size(); ++idx) {
+    ASSERT_EQ(out[idx], trie.find(keys[idx]));
+  }
+  ASSERT_EQ(out[5 + 17], 17);
+}
+
+using flat_words = [:rsl::trie_type(make_words(400)):];
+
+template <std::size_t... Idx>
+int switch_flat(std::string_view str, std::index_sequence<Idx...>) {
+  return rsl::string_switch<flat_words>(str, [] { return int(Idx); }..., [] { return -1; });
+}
+
+TEST(Trie, SwitchFlat) {
+  constexpr auto words = define_static_array(make_words(400));
+  for (std::size_t idx = 0; idx < words.size(); ++idx) {
+    ASSERT_EQ(switch_flat(words[idx], std::make_index_sequence<400>{}), int(idx));
+  }
+  ASSERT_EQ(switch_flat("w0_0x", std::make_index_sequence<400>{}), -1);
+}
+
+TEST(Trie, CaseInsensitive) {
+  auto trie = rsl::trie{
+      {"Content-Length", "content-type", "ACCEPT-ENCODING-LONG-HEADER", "x`y", "x{y"},
+      rsl::byte_mapping::ascii_case_insensitive()
+  };
+
+  ASSERT_EQ(trie.find("content-length"), 0);
+  ASSERT_EQ(trie.find("CONTENT-LENGTH"), 0);
+  ASSERT_EQ(trie.find("Content-Type"), 1);
+  ASSERT_EQ(trie.find("accept-encoding-long-header"), 2);
+  ASSERT_EQ(trie.find("Accept-Encoding-Long-Header"), 2);
+
+  // '@' and '[' differ from '`' and '{' only in the case bit, but are not letters
+  ASSERT_EQ(trie.find("x`y"), 3);
+  ASSERT_EQ(trie.find("x@y"), -1);
+  ASSERT_EQ(trie.find("X{Y"), 4);
+  ASSERT_EQ(trie.find("x[y"), -1);
+  ASSERT_EQ(trie.find("content_length"), -1);
+  ASSERT_EQ(trie.find("content-length\xe0"), -1);
+}
+
+
+TEST(Trie, CustomMapping) {
+  // treat '_' and '-' as the same character
+  constexpr auto mapping =
+      rsl::byte_mapping::custom([](unsigned char c) { return c == '_' ? '-' : c; });
+  auto trie = rsl::trie{
+      {"max-size", "min-size"},
+      mapping
+  };
+
+  ASSERT_EQ(trie.find("max_size"), 0);
+  ASSERT_EQ(trie.find("min-size"), 1);
+  ASSERT_EQ(trie.find("MAX_SIZE"), -1);
+}
+
+TEST(Trie, FindFuzzy) {
+  auto trie = rsl::trie{
+      {"select", "delete", "insert", "update", "selected"}
+  };
+
+  ASSERT_EQ(trie.find_fuzzy("select", 0), (std::vector<rsl::fuzzy_match>{{0, 0}}));
+  ASSERT_EQ(trie.find_fuzzy("selcet", 2), (std::vector<rsl::fuzzy_match>{{0, 2}}));
+  ASSERT_EQ(trie.find_fuzzy("selectd", 1),
+            (std::vector<rsl::fuzzy_match>{
+                {0, 1},
+                {4, 1}
+  }));
+  ASSERT_EQ(trie.find_fuzzy("updte", 1), (std::vector<rsl::fuzzy_match>{{3, 1}}));
+  ASSERT_TRUE(trie.find_fuzzy("xyz", 2).empty());
+
+  // best matches first
+  auto matches = trie.find_fuzzy("delect", 3);
+  ASSERT_FALSE(matches.empty());
+  ASSERT_EQ(matches.front(), (rsl::fuzzy_match{0, 1}));
+  ASSERT_TRUE(std::ranges::contains(matches, rsl::fuzzy_match{1, 2}));
+  ASSERT_TRUE(std::ranges::is_sorted(matches, {}, &rsl::fuzzy_match::distance));
+}
+
+
+TEST(Trie, FindFuzzyFlat) {
+  auto trie = rsl::trie{make_words(400)};
+
+  auto matches = trie.find_fuzzy("w0_O", 1);
+  ASSERT_TRUE(std::ranges::contains(matches, rsl::fuzzy_match{399, 1}));
+  for (auto match : matches) {
+    ASSERT_LE(match.distance, 1);
+  }
 }
\ No newline at end of file
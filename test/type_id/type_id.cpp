@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+
+#include <rsl/type_id>
+
+namespace demo {
+struct Point {
+  int x;
+  int y;
+};
+
+struct Counted {
+  static inline int destroyed = 0;
+  ~Counted() { ++destroyed; }
+};
+
+class Opaque {
+  int value = 0;
+};
+
+struct Pinned {
+  ~Pinned() = delete;
+};
+}  // namespace demo
+
+TEST(TypeId, Stable) {
+  static_assert(rsl::type_id<demo::Point> == rsl::type_id<demo::Point>);
+  static_assert(rsl::type_id<demo::Point> != rsl::type_id<demo::Counted>);
+  static_assert(rsl::type_id<int> != rsl::type_id<unsigned>);
+  static_assert(rsl::type_id<demo::Point> == rsl::_impl::fnv1a("::demo::Point"));
+
+  constexpr std::uint64_t id = rsl::type_id<demo::Point>;
+  switch (id) {
+    case rsl::type_id<demo::Point>: break;
+    default: FAIL();
+  }
+}
+
+TEST(TypeId, Registry) {
+  auto registry = rsl::type_registry{};
+  ASSERT_EQ(registry.find(rsl::type_id<demo::Point>), nullptr);
+
+  auto const& info = registry.add<demo::Point>();
+  registry.add<demo::Point>();
+  registry.add<demo::Counted>();
+  ASSERT_EQ(registry.size(), 2);
+  ASSERT_TRUE(registry.contains(rsl::type_id<demo::Counted>));
+
+  auto const* found = registry.find(rsl::type_id<demo::Point>);
+  ASSERT_EQ(found, &info);
+  ASSERT_EQ(found->name, "::demo::Point");
+  ASSERT_EQ(found->size, sizeof(demo::Point));
+  ASSERT_EQ(found->alignment, alignof(demo::Point));
+
+  auto point = demo::Point{1, 2};
+  ASSERT_EQ(found->repr(&point), rsl::repr(point));
+
+  alignas(demo::Counted) unsigned char storage[sizeof(demo::Counted)];
+  auto* object = ::new (storage) demo::Counted{};
+  registry.find(rsl::type_id<demo::Counted>)->destroy(object);
+  ASSERT_EQ(demo::Counted::destroyed, 1);
+}
+
+TEST(TypeId, Unsupported) {
+  // classes with private members cannot be serialized
+  static_assert(rsl::type_info_of<demo::Opaque>.repr == nullptr);
+  static_assert(rsl::type_info_of<demo::Opaque>.destroy != nullptr);
+
+  static_assert(rsl::type_info_of<demo::Pinned>.destroy == nullptr);
+  static_assert(rsl::type_info_of<demo::Point>.repr != nullptr);
+}
\ No newline at end of file
@@ -16,6 +16,16 @@ TEST(Hash, DuplicateElements) {
   ASSERT_NE(hasher(variant1), hasher(variant2));
 }
 
+TEST(Hash, AdjacentIndex) {
+  // index + hash used to collide for integral alternatives whose values differ by one
+  using variant_type = rsl::variant<int, int>;
+  auto const hasher  = std::hash<variant_type>{};
+  auto const first   = variant_type(std::in_place_index<0>, 1);
+  auto const second  = variant_type(std::in_place_index<1>, 0);
+
+  ASSERT_NE(hasher(first), hasher(second));
+}
+
 TEST(Hash, Copy) {
   using variant_type  = rsl::variant<int, long>;
   auto const hasher   = std::hash<variant_type>{};